@@ -0,0 +1,243 @@
+# CEFCache.cmake
+# Stores the resolved CEF SDK layout so that unchanged reconfigures skip
+# download, extraction check, verification and library lookup
+
+# Bump when the layout of the state file changes
+set(_CEF_SDK_CACHE_FORMAT 2)
+set(_CEF_CMAKE_MODULE_DIR "${CMAKE_CURRENT_LIST_DIR}")
+set(CEF_SDK_CACHE_FILE "${CMAKE_CURRENT_BINARY_DIR}/_cef_cache/CEFResolvedSDK.cmake")
+
+# Variables restored as normal variables in the calling scope
+set(_CEF_SDK_CACHE_VARIABLES
+    CEF_SOURCE_DIR
+    CEF_INCLUDE_DIR
+    CEF_LIBRARY_DIR
+    CEF_BINARY_DIR
+    CEF_RESOURCE_DIR
+    CEF_FRAMEWORK_PATH
+    CEF_LIB_PATH
+    CEF_DLL_PATH
+    CEF_SO_PATH
+)
+
+# Deployment file lists, published as global properties so that
+# cef_deploy_runtime() sees them from any directory (including parent projects)
+set(_CEF_SDK_CACHE_PROPERTIES
+    CEF_DEPLOY_BINARY_FILES
+    CEF_DEPLOY_RESOURCE_FILES
+    CEF_DEPLOY_RESOURCE_DIRS
+)
+
+# Subset of the above that cef_verify_installation()/cef_find_libraries()
+# also publish as cache entries (visible to parent projects)
+set(_CEF_SDK_CACHE_ENTRIES
+    CEF_INCLUDE_DIR
+    CEF_LIBRARY_DIR
+    CEF_BINARY_DIR
+    CEF_RESOURCE_DIR
+    CEF_FRAMEWORK_PATH
+    CEF_LIB_PATH
+    CEF_DLL_PATH
+    CEF_SO_PATH
+)
+
+# Internal function computing the fingerprint of everything that influences SDK resolution
+function(_cef_sdk_cache_fingerprint output_var)
+    set(inputs
+        "format=${_CEF_SDK_CACHE_FORMAT}"
+        "url=${CEF_URL}"
+        "platform=${CEF_PLATFORM}"
+        "robust=${CEF_ROBUST_DOWNLOAD}"
+        "archive=${CEF_LOCAL_ARCHIVE_PATH}"
+        # FetchContent overrides and the build tree decide where the SDK is extracted
+        "fetch_source=${FETCHCONTENT_SOURCE_DIR_CEF_BINARIES}"
+        "fetch_base=${FETCHCONTENT_BASE_DIR}"
+        "binary_dir=${CMAKE_BINARY_DIR}"
+    )
+
+    # An archive or SDK replaced in place must invalidate the cache
+    if(CEF_LOCAL_ARCHIVE_PATH AND EXISTS "${CEF_LOCAL_ARCHIVE_PATH}")
+        file(TIMESTAMP "${CEF_LOCAL_ARCHIVE_PATH}" archive_stamp "%s" UTC)
+        list(APPEND inputs "archive_stamp=${archive_stamp}")
+    endif()
+    _cef_get_root_dir(cef_root_dir)
+    list(APPEND inputs "root=${cef_root_dir}")
+    if(cef_root_dir AND EXISTS "${cef_root_dir}/include/cef_version.h")
+        file(TIMESTAMP "${cef_root_dir}/include/cef_version.h" root_stamp "%s" UTC)
+        list(APPEND inputs "root_stamp=${root_stamp}")
+    endif()
+
+    # Changes to the resolution logic itself must invalidate the cache
+    foreach(module CEFCache CEFDownload CEFPlatform CEFDeployment)
+        file(TIMESTAMP "${_CEF_CMAKE_MODULE_DIR}/${module}.cmake" module_stamp "%s" UTC)
+        list(APPEND inputs "${module}=${module_stamp}")
+    endforeach()
+
+    string(SHA256 fingerprint "${inputs}")
+    set(${output_var} "${fingerprint}" PARENT_SCOPE)
+endfunction()
+
+# Internal function stamping the SDK directories that hold deployed files.
+# A directory's modification time changes when entries are added or removed, so
+# optional files (libminigbm.so, dxcompiler.dll, locales, ...) appearing or
+# disappearing in place invalidate the cached deployment lists.
+function(_cef_sdk_cache_layout_stamp output_var)
+    set(directories "${CEF_SOURCE_DIR}" "${CEF_LIBRARY_DIR}" "${CEF_RESOURCE_DIR}")
+    list(REMOVE_DUPLICATES directories)
+    set(stamps "")
+    foreach(directory ${directories})
+        if(IS_DIRECTORY "${directory}")
+            file(TIMESTAMP "${directory}" directory_stamp "%s" UTC)
+            list(APPEND stamps "${directory}=${directory_stamp}")
+        endif()
+    endforeach()
+    set(${output_var} "${stamps}" PARENT_SCOPE)
+endfunction()
+
+# Try to restore the resolved SDK layout.
+# Sets <hit_var> to TRUE and restores all resolved variables on success.
+function(cef_sdk_cache_load hit_var)
+    set(${hit_var} FALSE PARENT_SCOPE)
+
+    _cef_sdk_cache_fingerprint(fingerprint)
+    set(CEF_SDK_CACHE_FINGERPRINT "${fingerprint}" PARENT_SCOPE)
+
+    if(NOT CEF_SDK_CACHE)
+        return()
+    endif()
+    if(NOT EXISTS "${CEF_SDK_CACHE_FILE}")
+        message(STATUS "CEF SDK cache: no previous state, resolving SDK")
+        return()
+    endif()
+
+    set(_CEF_CACHED_FINGERPRINT "")
+    set(_CEF_CACHED_LAYOUT_STAMP "")
+    include("${CEF_SDK_CACHE_FILE}")
+    if(NOT _CEF_CACHED_FINGERPRINT STREQUAL fingerprint)
+        message(STATUS "CEF SDK cache: inputs changed, resolving SDK")
+        return()
+    endif()
+
+    # The extracted SDK may have been removed behind our back
+    set(sentinels "${CEF_SOURCE_DIR}/include/cef_version.h")
+    foreach(library_var CEF_FRAMEWORK_PATH CEF_LIB_PATH CEF_DLL_PATH CEF_SO_PATH)
+        if(${library_var})
+            list(APPEND sentinels "${${library_var}}")
+        endif()
+    endforeach()
+    foreach(sentinel ${sentinels})
+        if(NOT EXISTS "${sentinel}")
+            message(STATUS "CEF SDK cache: ${sentinel} is missing, resolving SDK")
+            return()
+        endif()
+    endforeach()
+    _cef_sdk_cache_layout_stamp(layout_stamp)
+    if(NOT layout_stamp STREQUAL _CEF_CACHED_LAYOUT_STAMP)
+        message(STATUS "CEF SDK cache: SDK directory contents changed, resolving SDK")
+        return()
+    endif()
+
+    foreach(var ${_CEF_SDK_CACHE_ENTRIES})
+        if(DEFINED ${var} AND DEFINED _CEF_CACHED_HELP_${var})
+            set(${var} "${${var}}" CACHE STRING "${_CEF_CACHED_HELP_${var}}" FORCE)
+        endif()
+    endforeach()
+    foreach(var ${_CEF_SDK_CACHE_VARIABLES})
+        if(DEFINED ${var})
+            set(${var} "${${var}}" PARENT_SCOPE)
+        endif()
+    endforeach()
+    foreach(property ${_CEF_SDK_CACHE_PROPERTIES})
+        if(DEFINED _CEF_CACHED_${property})
+            set_property(GLOBAL PROPERTY ${property} "${_CEF_CACHED_${property}}")
+        endif()
+    endforeach()
+
+    message(STATUS "CEF SDK cache: reusing resolved SDK at ${CEF_SOURCE_DIR}")
+    set(${hit_var} TRUE PARENT_SCOPE)
+endfunction()
+
+# Internal function quoting a value for a set() command in the state file
+function(_cef_sdk_cache_quote value output_var)
+    string(REPLACE "\\" "\\\\" value "${value}")
+    string(REPLACE "\"" "\\\"" value "${value}")
+    string(REPLACE "$" "\\$" value "${value}")
+    set(${output_var} "\"${value}\"" PARENT_SCOPE)
+endfunction()
+
+# Capture the resolved SDK variables right after cef_find_libraries().
+# The SDK's cef_variables.cmake (included by CEFWrapper.cmake) later overwrites
+# normal variables such as CEF_BINARY_DIR and CEF_RESOURCE_DIR.
+function(cef_sdk_cache_snapshot)
+    foreach(var ${_CEF_SDK_CACHE_VARIABLES})
+        if(DEFINED ${var})
+            set(_CEF_SDK_RESOLVED_${var} "${${var}}" PARENT_SCOPE)
+        else()
+            unset(_CEF_SDK_RESOLVED_${var} PARENT_SCOPE)
+        endif()
+    endforeach()
+endfunction()
+
+# Record the resolved SDK layout for the next configure.
+# Must be called after cef_sdk_cache_snapshot() and once CEFDeployment.cmake is included.
+function(cef_sdk_cache_store)
+    if(NOT CEF_SDK_CACHE)
+        file(REMOVE "${CEF_SDK_CACHE_FILE}")
+        return()
+    endif()
+
+    # Work from the values captured by cef_sdk_cache_snapshot()
+    foreach(var ${_CEF_SDK_CACHE_VARIABLES})
+        if(DEFINED _CEF_SDK_RESOLVED_${var})
+            set(${var} "${_CEF_SDK_RESOLVED_${var}}")
+        else()
+            unset(${var})
+        endif()
+    endforeach()
+
+    # Precompute the deployment file lists (these probe the SDK for optional files)
+    # and publish them for the deployment calls made after this configure step
+    if(COMMAND _cef_get_binary_files)
+        _cef_get_binary_files(CEF_DEPLOY_BINARY_FILES)
+        _cef_get_resource_files(CEF_DEPLOY_RESOURCE_FILES)
+        _cef_get_resource_directories(CEF_DEPLOY_RESOURCE_DIRS)
+        foreach(property ${_CEF_SDK_CACHE_PROPERTIES})
+            set_property(GLOBAL PROPERTY ${property} "${${property}}")
+        endforeach()
+    endif()
+
+    set(content "# Generated by CEFCache.cmake - do not edit\n")
+    _cef_sdk_cache_quote("${CEF_SDK_CACHE_FINGERPRINT}" quoted)
+    string(APPEND content "set(_CEF_CACHED_FINGERPRINT ${quoted})\n")
+    _cef_sdk_cache_layout_stamp(layout_stamp)
+    _cef_sdk_cache_quote("${layout_stamp}" quoted)
+    string(APPEND content "set(_CEF_CACHED_LAYOUT_STAMP ${quoted})\n")
+    foreach(var ${_CEF_SDK_CACHE_VARIABLES})
+        if(DEFINED ${var})
+            _cef_sdk_cache_quote("${${var}}" quoted)
+            string(APPEND content "set(${var} ${quoted})\n")
+        endif()
+    endforeach()
+    foreach(property ${_CEF_SDK_CACHE_PROPERTIES})
+        if(DEFINED ${property})
+            _cef_sdk_cache_quote("${${property}}" quoted)
+            string(APPEND content "set(_CEF_CACHED_${property} ${quoted})\n")
+        endif()
+    endforeach()
+    foreach(var ${_CEF_SDK_CACHE_ENTRIES})
+        if(DEFINED CACHE{${var}})
+            get_property(help CACHE ${var} PROPERTY HELPSTRING)
+            _cef_sdk_cache_quote("${help}" quoted)
+            string(APPEND content "set(_CEF_CACHED_HELP_${var} ${quoted})\n")
+        endif()
+    endforeach()
+
+    # Only touch the file when its content changes
+    if(EXISTS "${CEF_SDK_CACHE_FILE}")
+        file(READ "${CEF_SDK_CACHE_FILE}" previous)
+        if(previous STREQUAL content)
+            return()
+        endif()
+    endif()
+    file(WRITE "${CEF_SDK_CACHE_FILE}" "${content}")
+endfunction()
@@ -3,6 +3,11 @@
 
 # Include CEF macros for file operations (only if CEF is properly configured)
 function(_cef_include_macros_if_available)
+    # Commands are global: skip re-parsing once the wrapper has loaded the macros
+    if(COMMAND SET_EXECUTABLE_TARGET_PROPERTIES)
+        set(CEF_MACROS_AVAILABLE TRUE PARENT_SCOPE)
+        return()
+    endif()
     if(DEFINED CEF_SOURCE_DIR AND EXISTS "${CEF_SOURCE_DIR}/cmake/cef_macros.cmake")
         include("${CEF_SOURCE_DIR}/cmake/cef_macros.cmake" PARENT_SCOPE)
         set(CEF_MACROS_AVAILABLE TRUE PARENT_SCOPE)
@@ -39,6 +44,14 @@ endfunction()
 
 # Get list of CEF binary files for deployment
 function(_cef_get_binary_files output_var)
+    # Reuse the list recorded by the CEF SDK cache when available
+    get_property(cached_list_set GLOBAL PROPERTY CEF_DEPLOY_BINARY_FILES SET)
+    if(cached_list_set)
+        get_property(cached_list GLOBAL PROPERTY CEF_DEPLOY_BINARY_FILES)
+        set(${output_var} "${cached_list}" PARENT_SCOPE)
+        return()
+    endif()
+
     _cef_set_deployment_variables()
     
     set(binary_files "")
@@ -84,6 +97,13 @@ endfunction()
 
 # Get list of CEF resource files for deployment
 function(_cef_get_resource_files output_var)
+    get_property(cached_list_set GLOBAL PROPERTY CEF_DEPLOY_RESOURCE_FILES SET)
+    if(cached_list_set)
+        get_property(cached_list GLOBAL PROPERTY CEF_DEPLOY_RESOURCE_FILES)
+        set(${output_var} "${cached_list}" PARENT_SCOPE)
+        return()
+    endif()
+
     _cef_set_deployment_variables()
     
     set(resource_files "")
@@ -101,6 +121,27 @@ function(_cef_get_resource_files output_var)
     set(${output_var} "${resource_files}" PARENT_SCOPE)
 endfunction()
 
+# Get list of CEF resource directories (locales, Resources) present in the SDK
+function(_cef_get_resource_directories output_var)
+    get_property(cached_list_set GLOBAL PROPERTY CEF_DEPLOY_RESOURCE_DIRS SET)
+    if(cached_list_set)
+        get_property(cached_list GLOBAL PROPERTY CEF_DEPLOY_RESOURCE_DIRS)
+        set(${output_var} "${cached_list}" PARENT_SCOPE)
+        return()
+    endif()
+
+    _cef_set_deployment_variables()
+
+    set(resource_dirs "")
+    foreach(dir locales Resources)
+        if(EXISTS "${CEF_RESOURCE_DIR}/${dir}")
+            list(APPEND resource_dirs "${dir}")
+        endif()
+    endforeach()
+
+    set(${output_var} "${resource_dirs}" PARENT_SCOPE)
+endfunction()
+
 # Main function to deploy CEF runtime files for a target
 function(cef_deploy_runtime target_name)
     if(NOT TARGET ${target_name})
@@ -151,6 +192,7 @@ function(_cef_deploy_linux target_name)
     # Get file lists
     _cef_get_binary_files(binary_files)
     _cef_get_resource_files(resource_files)
+    _cef_get_resource_directories(resource_dirs)
     
     # Deploy binary files using fallback approach (more reliable)
     if(binary_files)
@@ -183,7 +225,7 @@ function(_cef_deploy_linux target_name)
     endif()
     
     # Deploy locales directory
-    if(EXISTS "${CEF_RESOURCE_DIR}/locales")
+    if("locales" IN_LIST resource_dirs)
         add_custom_command(
             TARGET ${target_name}
             POST_BUILD
@@ -196,7 +238,7 @@ function(_cef_deploy_linux target_name)
     endif()
     
     # Deploy Resources directory (if exists)
-    if(EXISTS "${CEF_RESOURCE_DIR}/Resources")
+    if("Resources" IN_LIST resource_dirs)
         add_custom_command(
             TARGET ${target_name}
             POST_BUILD
@@ -236,6 +278,7 @@ function(_cef_deploy_windows target_name)
     # Get file lists
     _cef_get_binary_files(binary_files)
     _cef_get_resource_files(resource_files)
+    _cef_get_resource_directories(resource_dirs)
     
     # Deploy binary files using fallback approach (more reliable)
     if(binary_files)
@@ -268,7 +311,7 @@ function(_cef_deploy_windows target_name)
     endif()
     
     # Deploy locales directory
-    if(EXISTS "${CEF_RESOURCE_DIR}/locales")
+    if("locales" IN_LIST resource_dirs)
         add_custom_command(
             TARGET ${target_name}
             POST_BUILD
@@ -281,7 +324,7 @@ function(_cef_deploy_windows target_name)
     endif()
     
     # Deploy Resources directory (if exists)
-    if(EXISTS "${CEF_RESOURCE_DIR}/Resources")
+    if("Resources" IN_LIST resource_dirs)
         add_custom_command(
             TARGET ${target_name}
             POST_BUILD
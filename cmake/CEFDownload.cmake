@@ -178,8 +178,30 @@ function(_cef_verify_download_size archive_path)
     endif()
 endfunction()
 
+# Resolve CEF_ROOT to an absolute path (relative paths are taken from the top-level source directory)
+function(_cef_get_root_dir output_var)
+    if(CEF_ROOT)
+        get_filename_component(root_dir "${CEF_ROOT}" ABSOLUTE BASE_DIR "${CMAKE_SOURCE_DIR}")
+    else()
+        set(root_dir "")
+    endif()
+    set(${output_var} "${root_dir}" PARENT_SCOPE)
+endfunction()
+
 # Main function to download and extract CEF
 function(cef_download_and_extract)
+    # Use an already extracted SDK in place when CEF_ROOT is provided
+    if(CEF_ROOT)
+        _cef_get_root_dir(cef_root_dir)
+        if(NOT IS_DIRECTORY "${cef_root_dir}")
+            message(FATAL_ERROR "CEF_ROOT does not exist or is not a directory: ${CEF_ROOT}")
+        endif()
+        message(STATUS "CEF Platform: ${CEF_PLATFORM}")
+        message(STATUS "Using extracted CEF distribution from CEF_ROOT: ${cef_root_dir}")
+        set(CEF_SOURCE_DIR "${cef_root_dir}" PARENT_SCOPE)
+        return()
+    endif()
+
     include(FetchContent)
     
     # Display debug info
@@ -4,7 +4,23 @@
 option(CEF_ROBUST_DOWNLOAD "Enable robust download strategy with no timeouts" ON)
 option(CEF_USE_MINIMAL_DIST "Download the _minimal CEF distribution (recommended for most users)" OFF)
 set(CEF_LOCAL_ARCHIVE_PATH "" CACHE STRING "Path to a locally provided CEF archive (leave empty to download)")
+# Skipped only when a parent project set CEF_ROOT as a normal variable, which the
+# cache set() would otherwise clear. A -D value still gets its PATH type, so a
+# relative path is made absolute against the working directory.
+if(NOT DEFINED CEF_ROOT OR DEFINED CACHE{CEF_ROOT})
+    set(CEF_ROOT "" CACHE PATH "Path to an already extracted CEF binary distribution (used in place, skips download)")
+endif()
 set(MIN_CEF_ARCHIVE_SIZE 10000000 CACHE STRING "Minimum expected size for CEF archive in bytes")
+option(CEF_SDK_CACHE "Reuse the resolved CEF SDK layout on reconfigure when inputs are unchanged" ON)
+option(CEF_CONFIGURE_TIMING "Print a configure-time timing report for CEF packaging" OFF)
+
+# Verbose makefiles are only forced when CEF is the top-level project
+if(CMAKE_SOURCE_DIR STREQUAL CMAKE_CURRENT_SOURCE_DIR)
+    set(_CEF_IS_TOP_LEVEL ON)
+else()
+    set(_CEF_IS_TOP_LEVEL OFF)
+endif()
+option(CEF_VERBOSE_MAKEFILE "Enable CMAKE_VERBOSE_MAKEFILE for the CEF project" ${_CEF_IS_TOP_LEVEL})
 
 # For backward compatibility, also check the old variable name
 if(CEF_LOCAL_ARCHIVE AND NOT CEF_LOCAL_ARCHIVE_PATH)
@@ -0,0 +1,62 @@
+# CEFTiming.cmake
+# Configure-time timing report (enabled with CEF_CONFIGURE_TIMING)
+
+# Internal function returning the current time in milliseconds
+function(_cef_timing_now_ms output_var)
+    if(CMAKE_VERSION VERSION_GREATER_EQUAL 3.23)
+        # %f (microseconds) is only available since CMake 3.23
+        string(TIMESTAMP now_us "%s%f" UTC)
+        math(EXPR now_ms "${now_us} / 1000")
+    else()
+        string(TIMESTAMP now_s "%s" UTC)
+        math(EXPR now_ms "${now_s} * 1000")
+    endif()
+    set(${output_var} "${now_ms}" PARENT_SCOPE)
+endfunction()
+
+# Start measuring a configure phase
+function(cef_timing_begin phase)
+    if(NOT CEF_CONFIGURE_TIMING)
+        return()
+    endif()
+    _cef_timing_now_ms(now_ms)
+    set_property(GLOBAL PROPERTY CEF_TIMING_START_${phase} "${now_ms}")
+endfunction()
+
+# Stop measuring a configure phase, with an optional note shown in the report
+function(cef_timing_end phase)
+    if(NOT CEF_CONFIGURE_TIMING)
+        return()
+    endif()
+    _cef_timing_now_ms(now_ms)
+    get_property(start_ms GLOBAL PROPERTY CEF_TIMING_START_${phase})
+    if(NOT start_ms)
+        message(WARNING "cef_timing_end(${phase}) called without cef_timing_begin(${phase})")
+        return()
+    endif()
+    math(EXPR elapsed_ms "${now_ms} - ${start_ms}")
+    set_property(GLOBAL APPEND PROPERTY CEF_TIMING_PHASES "${phase}")
+    set_property(GLOBAL PROPERTY CEF_TIMING_ELAPSED_${phase} "${elapsed_ms}")
+    set_property(GLOBAL PROPERTY CEF_TIMING_NOTE_${phase} "${ARGN}")
+endfunction()
+
+# Print all measured phases
+function(cef_timing_report)
+    if(NOT CEF_CONFIGURE_TIMING)
+        return()
+    endif()
+    get_property(phases GLOBAL PROPERTY CEF_TIMING_PHASES)
+    message(STATUS "CEF configure timing:")
+    foreach(phase ${phases})
+        get_property(elapsed_ms GLOBAL PROPERTY CEF_TIMING_ELAPSED_${phase})
+        get_property(note GLOBAL PROPERTY CEF_TIMING_NOTE_${phase})
+        if(note)
+            message(STATUS "  ${phase}: ${elapsed_ms} ms (${note})")
+        else()
+            message(STATUS "  ${phase}: ${elapsed_ms} ms")
+        endif()
+    endforeach()
+    if(CMAKE_VERSION VERSION_LESS 3.23)
+        message(STATUS "  (timings have one second resolution before CMake 3.23)")
+    endif()
+endfunction()
@@ -0,0 +1,100 @@
+# cef_sdk_cache_test.cmake
+# Configures the CEF package against a fake SDK (CEF_ROOT mode) and checks the
+# SDK cache: warm reuse, invalidation on SDK changes, identical cache entries.
+#
+# Usage: cmake -DCEF_PROJECT_DIR=<repo> -DWORK_DIR=<dir> -DTEST_GENERATOR=<generator>
+#              [-DTEST_GENERATOR_PLATFORM=<platform>] -P cef_sdk_cache_test.cmake
+
+foreach(required CEF_PROJECT_DIR WORK_DIR TEST_GENERATOR)
+    if(NOT DEFINED ${required})
+        message(FATAL_ERROR "${required} must be defined")
+    endif()
+endforeach()
+
+set(SDK_DIR "${WORK_DIR}/sdk")
+set(BUILD_DIR "${WORK_DIR}/build")
+file(REMOVE_RECURSE "${WORK_DIR}")
+
+# Fake SDK layout covering the files looked up on every platform
+file(WRITE "${SDK_DIR}/include/cef_version.h" "#define CEF_VERSION \"fake\"\n")
+foreach(library libcef.so libcef.lib libcef.dll)
+    file(WRITE "${SDK_DIR}/Release/${library}" "")
+endforeach()
+file(MAKE_DIRECTORY "${SDK_DIR}/Release/Chromium Embedded Framework.framework")
+file(MAKE_DIRECTORY "${SDK_DIR}/Release/locales")
+
+# Mimic the real cef_variables.cmake, which overwrites these normal variables
+file(WRITE "${SDK_DIR}/cmake/cef_variables.cmake"
+    "set(CEF_BINARY_DIR \"\${_CEF_ROOT}/\${CMAKE_BUILD_TYPE}\")\n"
+    "set(CEF_RESOURCE_DIR \"\${_CEF_ROOT}/Resources\")\n"
+)
+file(WRITE "${SDK_DIR}/cmake/cef_macros.cmake" "")
+file(WRITE "${SDK_DIR}/libcef_dll/CMakeLists.txt" "add_library(libcef_dll_wrapper INTERFACE)\n")
+
+# Run a configure step and return its combined output
+function(run_configure output_var)
+    set(generator_args -G "${TEST_GENERATOR}")
+    if(TEST_GENERATOR_PLATFORM)
+        list(APPEND generator_args -A "${TEST_GENERATOR_PLATFORM}")
+    endif()
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -S "${CEF_PROJECT_DIR}" -B "${BUILD_DIR}" ${generator_args}
+                "-DCEF_ROOT=${SDK_DIR}"
+                -DBUILD_TESTING=OFF
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE error
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Configure failed (${result}):\n${output}\n${error}")
+    endif()
+    set(${output_var} "${output}" PARENT_SCOPE)
+endfunction()
+
+# Read the CEF_*_DIR / CEF_*_PATH entries from CMakeCache.txt
+function(read_cache_entries output_var)
+    file(STRINGS "${BUILD_DIR}/CMakeCache.txt" entries REGEX "^CEF_[A-Z_]+_(DIR|PATH):")
+    list(SORT entries)
+    set(${output_var} "${entries}" PARENT_SCOPE)
+endfunction()
+
+function(expect_output output expected)
+    string(FIND "${output}" "${expected}" position)
+    if(position EQUAL -1)
+        message(FATAL_ERROR "Expected \"${expected}\" in configure output:\n${output}")
+    endif()
+endfunction()
+
+function(expect_same_entries reference current step)
+    if(NOT reference STREQUAL current)
+        string(REPLACE ";" "\n  " reference "${reference}")
+        string(REPLACE ";" "\n  " current "${current}")
+        message(FATAL_ERROR "CEF cache entries differ after ${step}:\n"
+                            "cold:\n  ${reference}\n${step}:\n  ${current}")
+    endif()
+endfunction()
+
+# 1. Cold configure resolves the SDK
+run_configure(output)
+expect_output("${output}" "CEF SDK cache: no previous state, resolving SDK")
+read_cache_entries(cold_entries)
+if(NOT cold_entries)
+    message(FATAL_ERROR "No CEF cache entries found after the cold configure")
+endif()
+
+# 2. Warm configure reuses it and publishes the same cache entries
+run_configure(output)
+expect_output("${output}" "CEF SDK cache: reusing resolved SDK")
+read_cache_entries(warm_entries)
+expect_same_entries("${cold_entries}" "${warm_entries}" "warm configure")
+
+# 3. An optional deployment file appearing in place invalidates the cache
+#    (directory stamps have one second resolution)
+execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 1.1)
+file(WRITE "${SDK_DIR}/Release/libminigbm.so" "")
+run_configure(output)
+expect_output("${output}" "CEF SDK cache: SDK directory contents changed, resolving SDK")
+read_cache_entries(invalidated_entries)
+expect_same_entries("${cold_entries}" "${invalidated_entries}" "invalidated configure")
+
+message(STATUS "CEF SDK cache test passed")